@@ -0,0 +1,87 @@
+#include "lexer.h"
+#include "builtins.h"
+#include "parser.h"
+#include "interpreter.h"
+#include <chrono>
+
+/* Accuracy and throughput of the built-in functions against the while: loops
+ * scripts used before them. Every comparison runs ITERATIONS times with
+ * arguments taken from variables, so nothing is folded at parse time.
+ *
+ * Accuracy: one program computes the loop value l and the built-in value r in
+ * the same iteration and keeps the largest error seen in e. The benchmark fails
+ * when e exceeds TOLERANCE, so int comparisons must match exactly.
+ * Throughput: the loop and the built-in are timed in separate programs.
+ */
+
+const double TOLERANCE = 1e-12;
+const string ITERATIONS = "2000";
+
+struct Comparison {
+    string name;
+    string declarations;
+    string arguments;
+    string loop;
+    string builtin;
+    string error;
+};
+
+const Comparison comparisons[] = {
+        {"sqrt",
+         "int: i, k; double: s, l, r, e;",
+         "s = 2.0 + i",
+         "l = s; k = 0; while: k < 30 do: { l = (l + s / l) / 2.0; k = k + 1 }",
+         "r = sqrt(s)",
+         "abs(l - r) / r"},
+        {"exp",
+         "int: i, k; double: x, t, l, r, e;",
+         "x = 0.5 + i * 0.001",
+         "t = 1.0; l = 1.0; k = 1; while: k < 40 do: { t = t * x / k; l = l + t; k = k + 1 }",
+         "r = exp(x)",
+         "abs(l - r) / r"},
+        {"pow",
+         "int: i, k, n; double: b, l, r, e;",
+         "b = 1.0 + i * 0.0001; n = 20",
+         "l = 1.0; k = 0; while: k < n do: { l = l * b; k = k + 1 }",
+         "r = pow(b, n)",
+         "abs(l - r) / r"},
+        {"int pow",
+         "int: i, k, n, b, l, r, e;",
+         "b = i - i / 3 * 3 + 2; n = i - i / 6 * 6 + 10",
+         "l = 1; k = 0; while: k < n do: { l = l * b; k = k + 1 }",
+         "r = pow(b, n)",
+         "abs(l - r)"}
+};
+
+string iterate(const Comparison& comparison, const string& body){
+    return "program: " + comparison.declarations + " { i = 0; e = 0; while: i < " + ITERATIONS
+           + " do: { " + comparison.arguments + "; " + body + "; i = i + 1 } }";
+}
+
+double runProgram(const string& program){
+    intVars.clear();
+    doubleVars.clear();
+    ASTNode* node = parseTokens(program);
+    auto start = chrono::steady_clock::now();
+    interpretProgram(node);
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(){
+    bool accurate = true;
+    cout << "function, max error, loop (ms), built-in (ms)" << endl;
+    for (const auto& comparison:comparisons){
+        runProgram(iterate(comparison, comparison.loop + "; " + comparison.builtin
+                                       + "; e = max(e, " + comparison.error + ")"));
+        double maxError = intVars.find("e") != intVars.end() ? intVars["e"] : doubleVars["e"];
+
+        double loopTime = runProgram(iterate(comparison, comparison.loop));
+        double builtinTime = runProgram(iterate(comparison, comparison.builtin));
+        cout << comparison.name << ", " << setprecision(3) << maxError << ", " << loopTime << ", " << builtinTime << endl;
+        if (maxError > TOLERANCE){
+            cerr << "Accuracy error: " << comparison.name << " differs from its loop" << endl;
+            accurate = false;
+        }
+    }
+    return accurate ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,73 @@
+#include "lexer.h"
+#include "builtins.h"
+#include "parser.h"
+#include "interpreter.h"
+#include "reactive.h"
+#include <chrono>
+
+/* Update latency of reactive mode against program size.
+ *
+ * The generated program has N assignments split into chains of CHAIN_LENGTH,
+ * each chain fed by its own input, so a single-input change affects
+ * CHAIN_LENGTH assignments whatever N is. Every update is compared against
+ * re-running the whole program with interpretProgram.
+ */
+
+const int CHAIN_LENGTH = 10;
+const int UPDATES = 1000;
+const int FULL_RUNS = 20;
+
+string chainVariable(int chain, int step){
+    return "v" + to_string(chain) + "x" + to_string(step);
+}
+
+string generateProgram(int size){
+    int chains = size / CHAIN_LENGTH;
+    string declarations = "int: ";
+    string statements;
+    for (int chain = 0; chain < chains; chain++){
+        declarations += (chain == 0 ? "in" : ", in") + to_string(chain);
+        for (int step = 0; step < CHAIN_LENGTH; step++){
+            declarations += ", " + chainVariable(chain, step);
+            statements += statements.empty() ? "" : "; ";
+            if (step == 0){
+                statements += chainVariable(chain, step) + " = in" + to_string(chain) + " * 2";
+            } else {
+                statements += chainVariable(chain, step) + " = " + chainVariable(chain, step-1) + " + " + to_string(step);
+            }
+        }
+    }
+    return "program: " + declarations + "; { " + statements + " }";
+}
+
+int main(){
+    cout << "assignments, update (us), full run (us)" << endl;
+    for (int size : {10, 100, 1000}){
+        ASTNode* program = parseTokens(generateProgram(size));
+        reactiveProgram(program);
+
+        auto start = chrono::steady_clock::now();
+        for (int update = 1; update <= UPDATES; update++){
+            updateIntInput("in0", update);
+        }
+        double updateTime = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / UPDATES;
+
+        // last value of the chain: in0 * 2 + 1 + 2 + ... + (CHAIN_LENGTH-1)
+        int expected = UPDATES * 2 + CHAIN_LENGTH * (CHAIN_LENGTH - 1) / 2;
+        if (intVars[chainVariable(0, CHAIN_LENGTH-1)] != expected){
+            cerr << "Wrong result after update, assignments: " << size << endl;
+            return EXIT_FAILURE;
+        }
+
+        start = chrono::steady_clock::now();
+        for (int run = 0; run < FULL_RUNS; run++){
+            intVars.clear();
+            doubleVars.clear();
+            interpretProgram(program);
+        }
+        double fullTime = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / FULL_RUNS;
+
+        cout << size << ", " << updateTime << ", " << fullTime << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+#ifndef CALCULATOR_DSL_BUILTINS_H
+#define CALCULATOR_DSL_BUILTINS_H
+
+/* Built-in math functions. Calls are resolved against this table at parse time,
+ * so the interpreter calls the function pointers stored in the AST directly.
+ * applyInt is used when the call appears in an int expression; functions without
+ * it (sqrt, exp, log, sin, cos) are a type mismatch there. applyInt returns
+ * false when the arguments have no integer result.
+ */
+
+#include <climits>
+#include <cmath>
+
+const int MAX_INTRINSIC_ARGS = 2;
+
+struct Intrinsic {
+    const char* name;
+    int arity;
+    double (*apply)(const double* args);
+    bool (*applyInt)(const int* args, int& result);
+};
+
+double intrinsicSqrt(const double* args){ return sqrt(args[0]); }
+double intrinsicAbs(const double* args){ return fabs(args[0]); }
+double intrinsicMin(const double* args){ return fmin(args[0], args[1]); }
+double intrinsicMax(const double* args){ return fmax(args[0], args[1]); }
+double intrinsicFloor(const double* args){ return floor(args[0]); }
+double intrinsicExp(const double* args){ return exp(args[0]); }
+double intrinsicLog(const double* args){ return log(args[0]); }
+double intrinsicSin(const double* args){ return sin(args[0]); }
+double intrinsicCos(const double* args){ return cos(args[0]); }
+
+// Fast paths for squares and cubes. A square rounds once, like pow; a cube
+// rounds twice, so it may differ from pow by about an ulp. Everything else
+// goes to pow, which is more accurate than repeated multiplication.
+double intrinsicPow(const double* args){
+    if (args[1] == 2){
+        return args[0] * args[0];
+    } else if (args[1] == 3){
+        return args[0] * args[0] * args[0];
+    }
+    return pow(args[0], args[1]);
+}
+
+// Fails on INT_MIN, whose absolute value is not an int.
+bool intrinsicIntAbs(const int* args, int& result){
+    if (args[0] == INT_MIN){
+        return false;
+    }
+    result = args[0] < 0 ? -args[0] : args[0];
+    return true;
+}
+
+bool intrinsicIntMin(const int* args, int& result){
+    result = args[0] < args[1] ? args[0] : args[1];
+    return true;
+}
+
+bool intrinsicIntMax(const int* args, int& result){
+    result = args[0] > args[1] ? args[0] : args[1];
+    return true;
+}
+
+bool intrinsicIntFloor(const int* args, int& result){
+    result = args[0];
+    return true;
+}
+
+// Exponentiation by squaring; fails on a negative exponent or int overflow.
+bool intrinsicIntPow(const int* args, int& result){
+    if (args[1] < 0){
+        return false;
+    }
+    long long power = 1;
+    long long base = args[0];
+    int exponent = args[1];
+    while (exponent > 0){
+        if (exponent & 1){
+            power *= base;
+            if (power > INT_MAX || power < INT_MIN){
+                return false;
+            }
+        }
+        exponent >>= 1;
+        if (exponent > 0){
+            base *= base;
+            if (base > INT_MAX){
+                return false;
+            }
+        }
+    }
+    result = power;
+    return true;
+}
+
+const Intrinsic intrinsics[] = {
+        {"sqrt", 1, intrinsicSqrt, nullptr},
+        {"abs", 1, intrinsicAbs, intrinsicIntAbs},
+        {"min", 2, intrinsicMin, intrinsicIntMin},
+        {"max", 2, intrinsicMax, intrinsicIntMax},
+        {"floor", 1, intrinsicFloor, intrinsicIntFloor},
+        {"pow", 2, intrinsicPow, intrinsicIntPow},
+        {"exp", 1, intrinsicExp, nullptr},
+        {"log", 1, intrinsicLog, nullptr},
+        {"sin", 1, intrinsicSin, nullptr},
+        {"cos", 1, intrinsicCos, nullptr}
+};
+
+const Intrinsic* findIntrinsic(const string& name){
+    for (const auto& intrinsic:intrinsics){
+        if (name == intrinsic.name){
+            return &intrinsic;
+        }
+    }
+    return nullptr;
+}
+
+#endif //CALCULATOR_DSL_BUILTINS_H
@@ -45,6 +45,36 @@ double interpretDoubleNumber(ASTNode* node){
     return stod(node->token.value);
 }
 
+double interpretDoubleExpression(ASTNode* node);
+int interpretIntExpression(ASTNode* node);
+
+double interpretDoubleCall(ASTNode* node){
+    double args[MAX_INTRINSIC_ARGS] = {};
+    for (int i = 0; i < node->children.size(); i++){
+        args[i] = interpretDoubleExpression(node->children[i]);
+    }
+    double result = node->intrinsic->apply(args);
+    if (!isfinite(result)){
+        error("Runtime error: Invalid argument to " + node->token.value + ", line: " + to_string(node->token.line));
+    }
+    return result;
+}
+
+int interpretIntCall(ASTNode* node){
+    if (node->intrinsic->applyInt == nullptr){
+        error("Runtime error: Type mismatch, line: " + to_string(node->token.line));
+    }
+    int args[MAX_INTRINSIC_ARGS] = {};
+    for (int i = 0; i < node->children.size(); i++){
+        args[i] = interpretIntExpression(node->children[i]);
+    }
+    int result;
+    if (!node->intrinsic->applyInt(args, result)){
+        error("Runtime error: Invalid argument to " + node->token.value + ", line: " + to_string(node->token.line));
+    }
+    return result;
+}
+
 double interpretDoubleExpression(ASTNode* node){
     if (node->token.type == IDENTIFIER){
         if (intVars.find(node->token.value) != intVars.end()){
@@ -58,6 +88,8 @@ double interpretDoubleExpression(ASTNode* node){
         return 1.0*interpretIntNumber(node);
     } else if (node->token.type == DOUBLE_NUMBER){
         return interpretDoubleNumber(node);
+    } else if (node->token.type == CALL){
+        return interpretDoubleCall(node);
     } else if (node->token.type == PLUS && node->right == nullptr){
         return interpretDoubleExpression(node->left);
     } else if (node->token.type == MINUS && node->right == nullptr){
@@ -92,6 +124,8 @@ int interpretIntExpression(ASTNode* node){
         return interpretIntNumber(node);
     } else if (node->token.type == DOUBLE_NUMBER){
         error("Runtime error: Type mismatch, line: " + to_string(node->token.line));
+    } else if (node->token.type == CALL){
+        return interpretIntCall(node);
     } else if (node->token.type == PLUS && node->right == nullptr){
         return interpretIntExpression(node->left);
     } else if (node->token.type == MINUS && node->right == nullptr){
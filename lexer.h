@@ -37,7 +37,8 @@ enum TokenType {
     UNKNOWN,
     PRINTst,
     COMMA,
-    PROGRAM
+    PROGRAM,
+    CALL
 };
 
 struct Token {
@@ -77,6 +78,7 @@ string toStr(enum TokenType type){
         case PRINTst: return "PRINTst";
         case COMMA: return "COMMA";
         case PROGRAM: return "PROGRAM";
+        case CALL: return "CALL";
         default: return "UNKNOWN";
     }
 }
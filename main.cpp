@@ -1,6 +1,8 @@
 #include "lexer.h"
+#include "builtins.h"
 #include "parser.h"
 #include "interpreter.h"
+#include "reactive.h"
 #include <fstream>
 
 int main(){
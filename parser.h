@@ -24,13 +24,16 @@ term = factor {("*"|"/") factor} .
 factor =
 ident
 | number
+| ident "(" expression {"," expression} ")"
 | "(" expression ")"
 
 */
 
 
 //#include "lexer.h"
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -52,6 +55,9 @@ void nextTok() {
     position++;
     if (position < tokens.size()){
         tok = tokens[position];
+    } else if (position == tokens.size()){
+        // end of input: no token left after the last one was consumed
+        tok = {"", UNKNOWN, tok.line};
     } else {
         error("Syntax error: Expected token, line: " + to_string(tok.line));
     }
@@ -63,6 +69,7 @@ struct ASTNode{
     ASTNode *left;
     ASTNode *right;
     vector<ASTNode*> children;
+    const Intrinsic* intrinsic = nullptr;
 };
 
 ASTNode *expression();
@@ -83,9 +90,82 @@ bool expect(TokenType tokType) {
     return false;
 }
 
+// Returns the number literal of a call argument, which may carry a unary sign.
+ASTNode* literalArgument(ASTNode* node, bool& negative){
+    negative = false;
+    if ((node->token.type == PLUS || node->token.type == MINUS) && node->right == nullptr){
+        negative = node->token.type == MINUS;
+        node = node->left;
+    }
+    if (node->token.type == INT_NUMBER || node->token.type == DOUBLE_NUMBER){
+        return node;
+    }
+    return nullptr;
+}
+
+// Replaces a call whose arguments are all literals by its result. Int calls are
+// folded only when the int and double results agree, since either may be used.
+ASTNode* foldConstantCall(ASTNode* node){
+    double args[MAX_INTRINSIC_ARGS] = {};
+    int intArgs[MAX_INTRINSIC_ARGS] = {};
+    bool allInt = true;
+    for (int i = 0; i < node->children.size(); i++){
+        bool negative;
+        ASTNode* literal = literalArgument(node->children[i], negative);
+        if (literal == nullptr){
+            return node;
+        }
+        if (literal->token.type == INT_NUMBER){
+            intArgs[i] = negative ? -stoi(literal->token.value) : stoi(literal->token.value);
+            args[i] = intArgs[i];
+        } else {
+            args[i] = negative ? -stod(literal->token.value) : stod(literal->token.value);
+            allInt = false;
+        }
+    }
+    double result = node->intrinsic->apply(args);
+    if (!isfinite(result)){
+        return node;
+    }
+    if (allInt && node->intrinsic->applyInt != nullptr){
+        int intResult;
+        if (!node->intrinsic->applyInt(intArgs, intResult) || intResult != result){
+            return node;
+        }
+        node->token = {to_string(intResult), INT_NUMBER, node->token.line};
+    } else {
+        ostringstream value;
+        value << setprecision(17) << result;
+        node->token = {value.str(), DOUBLE_NUMBER, node->token.line};
+    }
+    node->children.clear();
+    node->intrinsic = nullptr;
+    return node;
+}
+
+ASTNode* functionCall() {
+    const Intrinsic* intrinsic = findIntrinsic(tok.value);
+    if (intrinsic == nullptr){
+        error("Factor: Unknown function: " + tok.value + ", line: " + to_string(tok.line));
+    }
+    auto node = new ASTNode{{tok.value, CALL, tok.line}, nullptr, nullptr, {}, intrinsic};
+    nextTok();
+    do {
+        nextTok();
+        node->children.push_back(expression());
+    } while (accept(COMMA));
+    expect(RPar);
+    if (node->children.size() != intrinsic->arity){
+        error("Factor: Wrong number of arguments to " + node->token.value + ", line: " + to_string(node->token.line) + ", expected: " + to_string(intrinsic->arity) + ", found: " + to_string(node->children.size()));
+    }
+    return foldConstantCall(node);
+}
+
 ASTNode* factor() {
     ASTNode* node = nullptr;
-    if (accept(IDENTIFIER)){
+    if (accept(IDENTIFIER) && position + 1 < tokens.size() && tokens[position+1].type == LPar){
+        node = functionCall();
+    } else if (accept(IDENTIFIER)){
         node = new ASTNode{tok, nullptr, nullptr, {}};
         nextTok();
     } else if (accept(INT_NUMBER) || accept(DOUBLE_NUMBER)){
@@ -242,6 +322,7 @@ ASTNode* program(){
 
 ASTNode* parseTokens(const string& input){
     tokens = lex(input, 1);
+    position = -1;
     nextTok();
     return program();
 }
@@ -0,0 +1,160 @@
+#ifndef CALCULATOR_DSL_REACTIVE_H
+#define CALCULATOR_DSL_REACTIVE_H
+
+/* Reactive mode for straight-line programs (assignments and prints only).
+ *
+ * Every assignment is a node of the dependency graph, with an edge from the
+ * assignment of a variable to each assignment that reads it. Variables that are
+ * never assigned are inputs. When the host updates an input, only assignments
+ * reachable from it are re-evaluated, in program order (a topological order of
+ * the graph), and propagation stops at values that did not change. All other
+ * values stay cached in intVars / doubleVars. Prints only run on the first pass.
+ */
+
+#include <set>
+
+vector<ASTNode*> reactiveAssignments;
+vector<vector<int>> reactiveDependents;
+map<string, int> reactiveWriters;
+map<string, vector<int>> reactiveInputReaders;
+
+
+void collectReads(ASTNode* node, vector<string>& reads){
+    if (node == nullptr){
+        return;
+    }
+    if (node->token.type == IDENTIFIER){
+        reads.push_back(node->token.value);
+    }
+    collectReads(node->left, reads);
+    collectReads(node->right, reads);
+    for (const auto& child:node->children){
+        collectReads(child, reads);
+    }
+}
+
+void collectStatements(ASTNode* node, vector<ASTNode*>& statements){
+    if (node->token.type == ASSIGN || node->token.type == PRINTst){
+        statements.push_back(node);
+    } else if (node->token.type == LBrackets){
+        int childNr = 0;
+        while (node->children[childNr] != nullptr){
+            collectStatements(node->children[childNr], statements);
+            childNr++;
+        }
+    } else {
+        error("Reactive error: Only straight-line programs are supported, line: " + to_string(node->token.line));
+    }
+}
+
+void buildDependencyGraph(ASTNode* node){
+    reactiveAssignments.clear();
+    reactiveDependents.clear();
+    reactiveWriters.clear();
+    reactiveInputReaders.clear();
+    vector<ASTNode*> statements;
+    collectStatements(node->children[0], statements);
+
+    set<string> unassignedReads;
+    for (const auto& statement:statements){
+        if (statement->token.type == PRINTst){
+            const string& name = statement->children[0]->token.value;
+            if (reactiveWriters.find(name) == reactiveWriters.end()){
+                unassignedReads.insert(name);
+            }
+            continue;
+        }
+
+        int current = reactiveAssignments.size();
+        reactiveAssignments.push_back(statement);
+        reactiveDependents.emplace_back();
+        vector<string> reads;
+        collectReads(statement->right, reads);
+        for (const auto& name:reads){
+            auto writer = reactiveWriters.find(name);
+            if (writer != reactiveWriters.end()){
+                reactiveDependents[writer->second].push_back(current);
+            } else {
+                reactiveInputReaders[name].push_back(current);
+                unassignedReads.insert(name);
+            }
+        }
+
+        const string& target = statement->left->token.value;
+        if (reactiveWriters.find(target) != reactiveWriters.end()){
+            error("Reactive error: Variable assigned more than once: " + target + ", line: " + to_string(statement->token.line));
+        }
+        if (unassignedReads.find(target) != unassignedReads.end()){
+            error("Reactive error: Variable read before assignment: " + target + ", line: " + to_string(statement->token.line));
+        }
+        reactiveWriters[target] = current;
+    }
+}
+
+// Loads a new model: variables of a previously loaded program are dropped.
+void reactiveProgram(ASTNode* node){
+    buildDependencyGraph(node);
+    intVars.clear();
+    doubleVars.clear();
+    interpretProgram(node);
+}
+
+void propagateUpdate(const string& name){
+    auto readers = reactiveInputReaders.find(name);
+    if (readers == reactiveInputReaders.end()){
+        return;
+    }
+    set<int> pending(readers->second.begin(), readers->second.end());
+    while (!pending.empty()){
+        int current = *pending.begin();
+        pending.erase(pending.begin());
+
+        ASTNode* assignment = reactiveAssignments[current];
+        const string& target = assignment->left->token.value;
+        bool changed;
+        if (intVars.find(target) != intVars.end()){
+            int previous = intVars[target];
+            interpretStatement(assignment);
+            changed = intVars[target] != previous;
+        } else {
+            double previous = doubleVars[target];
+            interpretStatement(assignment);
+            changed = doubleVars[target] != previous;
+        }
+        if (changed){
+            pending.insert(reactiveDependents[current].begin(), reactiveDependents[current].end());
+        }
+    }
+}
+
+void checkReactiveInput(const string& name){
+    if (reactiveWriters.find(name) != reactiveWriters.end()){
+        error("Reactive error: Variable is not an input: " + name);
+    }
+}
+
+void updateIntInput(const string& name, int value){
+    if (intVars.find(name) == intVars.end()){
+        error("Reactive error: Unknown int variable: " + name);
+    }
+    checkReactiveInput(name);
+    if (intVars[name] == value){
+        return;
+    }
+    intVars[name] = value;
+    propagateUpdate(name);
+}
+
+void updateDoubleInput(const string& name, double value){
+    if (doubleVars.find(name) == doubleVars.end()){
+        error("Reactive error: Unknown double variable: " + name);
+    }
+    checkReactiveInput(name);
+    if (doubleVars[name] == value){
+        return;
+    }
+    doubleVars[name] = value;
+    propagateUpdate(name);
+}
+
+#endif //CALCULATOR_DSL_REACTIVE_H